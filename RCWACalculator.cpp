@@ -1,4 +1,5 @@
 #include "RCWACalculator.h"
+#include "RCWAKernels.h"
 #include <QtConcurrent>
 #include <algorithm>
 
@@ -42,6 +43,18 @@ std::pair<double, double> RCWACalculator::calculateSingleWavelength(
     Complex ns = getRefractiveIndex(substrate, wavelength);
     Complex n0(1.0, 0.0); // 
 
+    //        
+    if (RCWAKernels::hasFixedKernel(materials.size())
+        && thicknesses.size() == materials.size()) {
+        std::array<Complex, RCWAKernels::kMaxFixedLayers> layerIndices;
+        for (int i = 0; i < materials.size(); ++i) {
+            //   n + ik,   N = n - ik
+            layerIndices[i] = std::conj(getRefractiveIndex(materials[i], wavelength));
+        }
+        return RCWAKernels::normalIncidence(layerIndices.data(), thicknesses.constData(),
+            materials.size(), n0, std::conj(ns), wavelength);
+    }
+
     //  RCWA  ()
     double k0 = 2.0 * M_PI / wavelength;
     // ...    ...
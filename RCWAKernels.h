@@ -0,0 +1,199 @@
+#pragma once
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @brief         
+ *
+ *    s-  p- ,  
+ *     .    
+ * ,       .
+ *      N = n - ik ( ).
+ */
+namespace RCWAKernels {
+
+    //   ,     
+    constexpr std::size_t kMinFixedLayers = 2;
+    constexpr std::size_t kMaxFixedLayers = 8;
+
+    // M_PI       MSVC  _USE_MATH_DEFINES
+    constexpr double kPi = 3.14159265358979323846;
+
+    using Complex = std::complex<double>;
+    using KernelResult = std::pair<double, double>; // {T, R}
+
+    /**
+     * @brief    k = 0
+     *
+     *      [[a, ib], [ic, d]]  
+     * a, b, c, d;      , 
+     *      .
+     */
+    struct RealMatrix {
+        double a, b, c, d;
+
+        static RealMatrix layer(double n, double thickness, double k0) {
+            const double delta = k0 * n * thickness;
+            const double cosD = std::cos(delta);
+            const double sinD = std::sin(delta);
+            return { cosD, sinD / n, n * sinD, cosD };
+        }
+
+        RealMatrix operator*(const RealMatrix& o) const {
+            return { a * o.a - b * o.c,
+                     a * o.b + b * o.d,
+                     c * o.a + d * o.c,
+                     d * o.d - c * o.b };
+        }
+    };
+
+    /**
+     * @brief    
+     */
+    struct ComplexMatrix {
+        Complex m11, m12, m21, m22;
+
+        static ComplexMatrix layer(Complex n, double thickness, double k0) {
+            const Complex I(0.0, 1.0);
+            const Complex delta = k0 * n * thickness;
+            const Complex cosD = std::cos(delta);
+            const Complex sinD = std::sin(delta);
+            return { cosD, I * sinD / n, I * n * sinD, cosD };
+        }
+
+        ComplexMatrix operator*(const ComplexMatrix& o) const {
+            return { m11 * o.m11 + m12 * o.m21,
+                     m11 * o.m12 + m12 * o.m22,
+                     m21 * o.m11 + m22 * o.m21,
+                     m21 * o.m12 + m22 * o.m22 };
+        }
+    };
+
+    namespace detail {
+        template<typename Matrix, typename Index, std::size_t... I>
+        Matrix multiplyLayers(const Index* n, const double* thicknesses, double k0,
+            std::index_sequence<I...>) {
+            Matrix m = Matrix::layer(n[0], thicknesses[0], k0);
+            ((m = m * Matrix::layer(n[I + 1], thicknesses[I + 1], k0)), ...);
+            return m;
+        }
+    }
+
+    /**
+     * @brief       (k = 0)
+     *
+     *      ,   :
+     *     .
+     * @tparam N  
+     */
+    template<std::size_t N>
+    KernelResult normalIncidenceReal(const double* n, const double* thicknesses,
+        double n0, Complex ns, double wavelength) {
+        static_assert(N >= 1, "At least one layer is required");
+
+        const double k0 = 2.0 * kPi / wavelength;
+        const RealMatrix m = detail::multiplyLayers<RealMatrix>(
+            n, thicknesses, k0, std::make_index_sequence<N - 1>{});
+
+        const Complex I(0.0, 1.0);
+        const Complex B = m.a + I * m.b * ns;
+        const Complex C = I * m.c + m.d * ns;
+        const double denom = std::norm(n0 * B + C);
+
+        const double T = 4.0 * n0 * ns.real() / denom;
+        const double R = std::norm(n0 * B - C) / denom;
+        return { T, R };
+    }
+
+    /**
+     * @brief       
+     * @tparam N  
+     */
+    template<std::size_t N>
+    KernelResult normalIncidenceComplex(const Complex* n, const double* thicknesses,
+        Complex n0, Complex ns, double wavelength) {
+        static_assert(N >= 1, "At least one layer is required");
+
+        const double k0 = 2.0 * kPi / wavelength;
+        const ComplexMatrix m = detail::multiplyLayers<ComplexMatrix>(
+            n, thicknesses, k0, std::make_index_sequence<N - 1>{});
+
+        const Complex B = m.m11 + m.m12 * ns;
+        const Complex C = m.m21 + m.m22 * ns;
+        const Complex sum = n0 * B + C;
+        const double denom = std::norm(sum);
+
+        const double T = 4.0 * n0.real() * ns.real() / denom;
+        const double R = std::norm(n0 * B - C) / denom;
+        return { T, R };
+    }
+
+    using RealKernel = KernelResult(*)(const double*, const double*, double, Complex, double);
+    using ComplexKernel = KernelResult(*)(const Complex*, const double*, Complex, Complex, double);
+
+    namespace detail {
+        template<std::size_t... I>
+        constexpr std::array<RealKernel, sizeof...(I)> makeRealTable(std::index_sequence<I...>) {
+            return { { &normalIncidenceReal<I + kMinFixedLayers>... } };
+        }
+
+        template<std::size_t... I>
+        constexpr std::array<ComplexKernel, sizeof...(I)> makeComplexTable(std::index_sequence<I...>) {
+            return { { &normalIncidenceComplex<I + kMinFixedLayers>... } };
+        }
+
+        constexpr std::size_t kTableSize = kMaxFixedLayers - kMinFixedLayers + 1;
+        inline constexpr auto realKernels = makeRealTable(std::make_index_sequence<kTableSize>{});
+        inline constexpr auto complexKernels = makeComplexTable(std::make_index_sequence<kTableSize>{});
+    }
+
+    inline bool hasFixedKernel(std::size_t layerCount) {
+        return layerCount >= kMinFixedLayers && layerCount <= kMaxFixedLayers;
+    }
+
+    enum class KernelPath { Real, Complex };
+
+    /**
+     * @brief       
+     *
+     *   :       ,
+     *       .
+     */
+    inline KernelPath selectKernelPath(const Complex* n, std::size_t layerCount, Complex n0) {
+        bool lossless = n0.imag() == 0.0;
+        for (std::size_t i = 0; lossless && i < layerCount; ++i) {
+            lossless = n[i].imag() == 0.0;
+        }
+        return lossless ? KernelPath::Real : KernelPath::Complex;
+    }
+
+    /**
+     * @brief        
+     * @param n    (N = n - ik)
+     * @param thicknesses   ()
+     * @param layerCount  ,   hasFixedKernel()
+     * @param n0    
+     * @param ns   
+     * @param wavelength   ()
+     * @return  {T, R}
+     */
+    inline KernelResult normalIncidence(const Complex* n, const double* thicknesses,
+        std::size_t layerCount, Complex n0, Complex ns, double wavelength) {
+
+        const std::size_t slot = layerCount - kMinFixedLayers;
+
+        if (selectKernelPath(n, layerCount, n0) == KernelPath::Real) {
+            std::array<double, kMaxFixedLayers> nReal{};
+            for (std::size_t i = 0; i < layerCount; ++i) {
+                nReal[i] = n[i].real();
+            }
+            return detail::realKernels[slot](nReal.data(), thicknesses,
+                n0.real(), ns, wavelength);
+        }
+
+        return detail::complexKernels[slot](n, thicknesses, n0, ns, wavelength);
+    }
+}
@@ -0,0 +1,110 @@
+//    RCWAKernels.h,     spectrum.
+//   : g++ -std=c++17 RCWAKernelsTest.cpp -o kernels_test && ./kernels_test
+#include "RCWAKernels.h"
+#include <cmath>
+#include <cstdio>
+#include <utility>
+
+using namespace RCWAKernels;
+
+namespace {
+    constexpr double kTolerance = 1e-12;
+    constexpr double kWavelength = 550.0;
+
+    int failures = 0;
+
+    void expectNear(double actual, double expected, const char* what, std::size_t layers) {
+        if (std::abs(actual - expected) > kTolerance) {
+            std::printf("FAIL N=%zu %s: %.15f != %.15f\n", layers, what, actual, expected);
+            ++failures;
+        }
+    }
+
+    //     ,  
+    struct Stack {
+        Complex n[kMaxFixedLayers];
+        double nReal[kMaxFixedLayers];
+        double thicknesses[kMaxFixedLayers];
+
+        Stack() {
+            for (std::size_t i = 0; i < kMaxFixedLayers; ++i) {
+                nReal[i] = (i % 2 == 0) ? 2.3 : 1.38;
+                n[i] = { nReal[i], 0.0 };
+                thicknesses[i] = kWavelength / (4.0 * nReal[i]) * (1.0 + 0.1 * i);
+            }
+        }
+    };
+
+    //  ;    ,   optical_coatings.db
+    template<std::size_t N>
+    void checkLossless(const Stack& s, Complex ns) {
+        const double n0 = 1.0;
+
+        if (selectKernelPath(s.n, N, n0) != KernelPath::Real) {
+            std::printf("FAIL N=%zu: lossless layers not sent to the real kernel\n", N);
+            ++failures;
+        }
+
+        const auto [Tr, Rr] = normalIncidenceReal<N>(s.nReal, s.thicknesses, n0, ns, kWavelength);
+        const auto [Tc, Rc] = normalIncidenceComplex<N>(s.n, s.thicknesses, n0, ns, kWavelength);
+        const auto [Td, Rd] = normalIncidence(s.n, s.thicknesses, N, n0, ns, kWavelength);
+
+        expectNear(Tr, Tc, "T real vs complex", N);
+        expectNear(Rr, Rc, "R real vs complex", N);
+        expectNear(Td, Tr, "T dispatch", N);
+        expectNear(Rd, Rr, "R dispatch", N);
+        expectNear(Tr + Rr, 1.0, "T + R", N);
+    }
+
+    template<std::size_t... I>
+    void checkAllLossless(const Stack& s, Complex ns, std::index_sequence<I...>) {
+        (checkLossless<I + kMinFixedLayers>(s, ns), ...);
+    }
+
+    //   : R = ((ns - n^2) / (ns + n^2))^2
+    void checkQuarterWave() {
+        const double n = 1.38;
+        const double ns = 1.52;
+        const double thickness = kWavelength / (4.0 * n);
+
+        const auto [T, R] = normalIncidenceReal<1>(&n, &thickness, 1.0, ns, kWavelength);
+        const double r = (ns - n * n) / (ns + n * n);
+        expectNear(R, r * r, "quarter-wave R", 1);
+        expectNear(T + R, 1.0, "quarter-wave T + R", 1);
+    }
+
+    //         
+    void checkAbsorbing(const Stack& s) {
+        Complex n[2] = { { 2.0, -0.1 }, s.n[1] };
+        const Complex ns(1.52, -6.6e-6);
+        if (selectKernelPath(n, 2, 1.0) != KernelPath::Complex) {
+            std::printf("FAIL N=2: absorbing layer treated as lossless\n");
+            ++failures;
+        }
+
+        const auto [T, R] = normalIncidence(n, s.thicknesses, 2, 1.0, ns, kWavelength);
+        const auto [Tc, Rc] = normalIncidenceComplex<2>(n, s.thicknesses, 1.0, ns, kWavelength);
+        expectNear(T, Tc, "absorbing T dispatch", 2);
+        expectNear(R, Rc, "absorbing R dispatch", 2);
+        if (!(T + R < 1.0 - 1e-6)) {
+            std::printf("FAIL N=2 absorbing: T + R = %.15f\n", T + R);
+            ++failures;
+        }
+    }
+}
+
+int main() {
+    const Stack s;
+    const auto kernels = std::make_index_sequence<detail::kTableSize>{};
+    checkAllLossless(s, { 1.52, 0.0 }, kernels);
+    checkAllLossless(s, { 1.52, -6.6e-6 }, kernels);
+    checkAllLossless(s, { 1.52, -0.05 }, kernels);
+    checkQuarterWave();
+    checkAbsorbing(s);
+
+    if (failures == 0) {
+        std::printf("All kernel checks passed\n");
+        return 0;
+    }
+    return 1;
+}